@@ -1,10 +1,10 @@
-#pragma once
-extern int last_disp_sz;
-extern int last_enter_sz;
-extern int last_fill_sz;
-
-void DispMemCommand();
-void FillMemCommand();
-void EnterMemCommand();
-void CompareMemCommand();
-void SearchMemCommand();
+#pragma once
+extern int last_disp_sz;
+extern int last_enter_sz;
+extern int last_fill_sz;
+
+void DispMemCommand();
+void FillMemCommand();
+void EnterMemCommand();
+void CompareMemCommand();
+void SearchMemCommand();
@@ -1,9 +1,9 @@
-#pragma once
-
-extern const char* rm16_strs[];
-
-extern const char* regs_8[];
-extern const char* regs_16[];
-extern const char* regs_32[];
-extern const char* seg_regs[];
-#pragma once
+#pragma once
+
+extern const char* rm16_strs[];
+
+extern const char* regs_8[];
+extern const char* regs_16[];
+extern const char* regs_32[];
+extern const char* seg_regs[];
+#pragma once
@@ -0,0 +1,67 @@
+/**
+ *      File: bench.h
+ *      Shared helpers for the DOSXPLOD timing programs
+ *      Copyright (c) 2025 by Will Klees
+ */
+
+#ifndef __BENCH_H_
+#define __BENCH_H_
+
+#include "../DOSCALLS.H"
+#include "../FORMAT.H"
+#include "../TIMER.H"
+#include "../I386INS.H"
+
+/**
+ *  BenchPrint routine - Formats a line and writes it to standard output.
+ * 
+ *  @param pszFmt: The format string, followed by its arguments.
+ */
+inline void BenchPrint(const CHAR* pszFmt, ...) {
+    CHAR szLine[128];
+    VA_LIST args;
+    ULONG cbWritten;
+    int cch;
+
+    VA_START(args, pszFmt);
+    cch = avsnprintf(szLine, sizeof(szLine), pszFmt, args);
+    VA_END(args);
+    if (cch > (int)sizeof(szLine) - 1) {
+        cch = sizeof(szLine) - 1;
+    }
+    DosWrite(1, szLine, cch, &cbWritten);
+}
+
+/**
+ *  BenchMicroseconds routine - Converts the interval between two counter
+ *  readings to microseconds.
+ * 
+ *  @param pStart: The reading taken before the timed work.
+ * 
+ *  @param pEnd: The reading taken after it.
+ * 
+ *  @return: The elapsed time in microseconds.
+ */
+inline DWORD BenchMicroseconds(PSYS_COUNTER pStart, PSYS_COUNTER pEnd) {
+    DWORD dwLow = pEnd->dwLow - pStart->dwLow;
+    DWORD dwHigh = pEnd->dwHigh - pStart->dwHigh - (pEnd->dwLow < pStart->dwLow);
+    DWORD dwFreq = SysQueryPerformanceFrequency();
+    DWORD dwUs;
+
+    /* Halve the count and the rate alike until the count fits in 32 bits */
+    while (dwHigh) {
+        dwLow = (dwLow >> 1) | (dwHigh << 31);
+        dwHigh >>= 1;
+        dwFreq >>= 1;
+    }
+    __asm {
+        mov eax, dwLow
+        mov edx, 1000000
+        mul edx                 ; EDX:EAX = Counts * 1000000
+        div dwFreq              ; EAX = Microseconds
+        mov dwUs, eax
+    }
+    return dwUs;
+}
+
+#endif
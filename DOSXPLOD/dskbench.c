@@ -0,0 +1,88 @@
+/**
+ *      File: dskbench.c
+ *      Sector read throughput with and without the track cache
+ *      Copyright (c) 2025 by Will Klees
+ * 
+ *      Reads the first tracks of the first floppy drive a sector at a time,
+ *      the way a file system walks a disk, three times over:
+ *      - uncached: one BioReadSectors call per sector, as before the cache;
+ *      - cold: DskReadSectors with nothing cached, so each track is read
+ *        whole by its first sector;
+ *      - warm: DskReadSectors again, with every track in the cache.
+ *      Rates are in KB/s (1024 bytes per second), followed by the cache's
+ *      own counts.
+ */
+
+#include "../BIOCALLS.H"
+#include "bench.h"
+
+#define DSKBENCH_DRIVE      0x00        /* The first floppy drive */
+#define DSKBENCH_TRACKS     4
+
+BYTE DskBenchSector[DSK_SECTOR_SIZE];
+
+/**
+ *  DskBenchRate routine - Prints one throughput figure.
+ * 
+ *  @param pszWhat: The name of the pass.
+ * 
+ *  @param dwSectors: The number of sectors read.
+ * 
+ *  @param pStart: The counter reading taken before the pass.
+ */
+void DskBenchRate(const CHAR* pszWhat, DWORD dwSectors, PSYS_COUNTER pStart) {
+    SYS_COUNTER End;
+    DWORD dwUs;
+
+    SysQueryPerformanceCounter(&End);
+    dwUs = BenchMicroseconds(pStart, &End);
+    if (dwUs == 0) dwUs = 1;
+
+    /* Sectors are half a KB, so KB/s = sectors * 500000 / microseconds */
+    BenchPrint("  %-10s %8u KB/s\r\n", pszWhat, dwSectors * 500000 / dwUs);
+}
+
+int mainCRTStartup() {
+    DRIVE_PARAMS Params;
+    DSK_CACHE_STATS Stats;
+    SYS_COUNTER Start;
+    DWORD dwSectors, dwLBA;
+    WORD wCylinder;
+    BYTE cSector, cHead, cStatus;
+    INT iPass;
+
+    cStatus = BioReadDriveParams(DSKBENCH_DRIVE, &Params);
+    if (cStatus || Params.cSectorsPerTrack == 0) {
+        BenchPrint("dskbench: cannot read the parameters of drive %02XH (status %02XH)\r\n", DSKBENCH_DRIVE, cStatus);
+        DosExit(1);
+    }
+    dwSectors = DSKBENCH_TRACKS * Params.cSectorsPerTrack;
+    BenchPrint("Drive %02XH, %u sectors a sector at a time:\r\n", DSKBENCH_DRIVE, dwSectors);
+
+    SysQueryPerformanceCounter(&Start);
+    for (dwLBA = 0; dwLBA < dwSectors; dwLBA++) {
+        DskLBAtoCHS(&Params, dwLBA, &wCylinder, &cSector, &cHead);
+        if (BioReadSectors(1, wCylinder, cSector, cHead, DSKBENCH_DRIVE, DskBenchSector) >> 8) {
+            BenchPrint("dskbench: read of sector %u failed\r\n", dwLBA);
+            DosExit(1);
+        }
+    }
+    DskBenchRate("uncached", dwSectors, &Start);
+
+    for (iPass = 0; iPass < 2; iPass++) {
+        SysQueryPerformanceCounter(&Start);
+        for (dwLBA = 0; dwLBA < dwSectors; dwLBA++) {
+            if (DskReadSectors(DSKBENCH_DRIVE, &Params, dwLBA, 1, DskBenchSector)) {
+                BenchPrint("dskbench: cached read of sector %u failed\r\n", dwLBA);
+                DosExit(1);
+            }
+        }
+        DskBenchRate(iPass ? "warm" : "cold", dwSectors, &Start);
+    }
+
+    DskGetCacheStats(&Stats);
+    BenchPrint("  %u hits, %u misses, %u track reads\r\n", Stats.dwHits, Stats.dwMisses, Stats.dwTrackReads);
+
+    DosExit(0);
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ *      File: rawbench.c
+ *      Round-trip latency of the real-mode call paths
+ *      Copyright (c) 2025 by Will Klees
+ * 
+ *      Issues two cheap real-mode services many times over by each of the
+ *      three ways a client can reach real mode: an INT instruction that the
+ *      host or the extender reflects, INT 31H Function 0300H, and the raw
+ *      mode switch of RAWCALL.C. INT 16H Function 01H (keyboard status) is
+ *      answered by the BIOS; INT 21H Function 30H (get DOS version) by DOS.
+ *      Each figure is the average time of one call.
+ */
+
+#include "../DOSCALLS.H"
+#include "../DPMI.H"
+#include "bench.h"
+
+#define RAWBENCH_CALLS      10000
+
+/**
+ *  RawBenchReflect routine - Issues an interrupt from protected mode, for
+ *  the host or the extender to reflect.
+ */
+void RawBenchReflect(BYTE intr, DPMIREGS* pRegs) {
+    DWORD dwEax = pRegs->EAX;
+
+    if (intr == 0x16) {
+        __asm {
+            mov eax, dwEax
+            int 16h
+        }
+    } else {
+        __asm {
+            mov eax, dwEax
+            int 21h
+        }
+    }
+}
+
+/**
+ *  RawBenchSimulate routine - Issues an interrupt through INT 31H Function
+ *  0300H.
+ */
+void RawBenchSimulate(BYTE intr, DPMIREGS* pRegs) {
+    DpmiSimulateRealModeInt(intr, 0, pRegs);
+}
+
+/**
+ *  RawBenchRaw routine - Issues an interrupt through the raw mode switch.
+ */
+void RawBenchRaw(BYTE intr, DPMIREGS* pRegs) {
+    DpmiRawCallInt(intr, pRegs);
+}
+
+/**
+ *  RawBenchRun routine - Times one way of reaching one service, and prints
+ *  the time of each call.
+ * 
+ *  @param pszName: The name of the call method.
+ * 
+ *  @param pfnCall: The routine issuing the call.
+ * 
+ *  @param intr: The interrupt number.
+ * 
+ *  @param dwEax: The EAX to issue it with.
+ */
+void RawBenchRun(CHAR* pszName, void (*pfnCall)(BYTE, DPMIREGS*), BYTE intr, DWORD dwEax) {
+    SYS_COUNTER Start, End;
+    DPMIREGS regs;
+    DWORD dwNs, i;
+
+    SysQueryPerformanceCounter(&Start);
+    for (i = 0; i < RAWBENCH_CALLS; i++) {
+        stosb((CHAR*)&regs, 0, sizeof(DPMIREGS));
+        regs.EAX = dwEax;
+        pfnCall(intr, &regs);
+    }
+    SysQueryPerformanceCounter(&End);
+
+    dwNs = BenchMicroseconds(&Start, &End) / (RAWBENCH_CALLS / 1000);
+    BenchPrint("  %-22s %5u.%02u us\r\n", pszName, dwNs / 1000, dwNs % 1000 / 10);
+}
+
+int mainCRTStartup() {
+    static BYTE aIntr[] = { 0x16, 0x21 };
+    static DWORD adwEax[] = { 0x0100, 0x3000 };
+    static CHAR* apszService[] = { "INT 16H AH=01H (BIOS)", "INT 21H AH=30H (DOS)" };
+    BOOL bRaw;
+    DWORD i;
+
+    bRaw = DpmiRawCallEnable(TRUE);
+    if (!bRaw) BenchPrint("rawbench: the host has no raw mode switch, the raw path falls back to 0300H\r\n");
+
+    for (i = 0; i < 2; i++) {
+        BenchPrint("%s, %u calls:\r\n", apszService[i], RAWBENCH_CALLS);
+        RawBenchRun("INT reflected", RawBenchReflect, aIntr[i], adwEax[i]);
+        RawBenchRun("INT 31H/0300H", RawBenchSimulate, aIntr[i], adwEax[i]);
+        RawBenchRun("Raw mode switch", RawBenchRaw, aIntr[i], adwEax[i]);
+    }
+
+    DpmiRawCallEnable(FALSE);
+    DosExit(0);
+    return 0;
+}